@@ -8,6 +8,9 @@
 #include <iostream>                // console I/O for error and debug messages
 #include <fstream>                  // file I/O
 #include <string>                  // file names
+#include <vector>                  // solver bookkeeping
+#include <random>                  // random walk solver
+#include <algorithm>               // std::fill
 #include <SFML/Graphics.hpp>    // 2d graphics library
 
 #include "maze_defs.h"  // global definitions
@@ -18,7 +21,7 @@
 
 // Animation Methods
 void processInput(sf::RenderWindow& window);
-bool update(Maze maze, Mouse &mouse, float lag);
+bool update(Maze maze, Mouse &mouse, Solver &solver, float lag);
 void render(sf::RenderWindow& window, Maze maze, Mouse mouse, float lag);
 
 // Maze Methods
@@ -28,18 +31,35 @@ bool isWallOn(Maze maze, int row, int column, BYTE wall);
 
 // Mouse Methods
 void initializeMouse(Mouse& mouse);
-void lookNext(Mouse& mouse);
+void turnToward(Mouse& mouse);
 void turnLeft(Mouse& mouse);
 void turnRight(Mouse& mouse);
 bool isFinishedTurning(Mouse& mouse);
 void startMoving(Mouse& mouse);
 bool isFinishedMoving(Mouse& mouse, Maze maze);
 float cardinalToRotational(BYTE cardinal);
+BYTE leftOf(BYTE cardinal);
+BYTE rightOf(BYTE cardinal);
+BYTE behind(BYTE cardinal);
+
+// Solver Methods
+Solver startSolver(int strategy, Maze maze, const Mouse& mouse, unsigned seed = 0);
+bool nextMove(Solver& solver, BYTE& move);
+void benchmarkSolvers(Maze maze);
+bool isOpen(Maze maze, int row, int column, BYTE direction);
+bool isGoal(Maze maze, int row, int column);
+void stepToward(BYTE direction, int& row, int& column);
+int directionIndex(BYTE direction);
+Solver wallFollower(Maze, const Mouse& mouse);
+Solver tremaux(Maze maze, const Mouse& mouse);
+Solver pledge(Maze maze, const Mouse& mouse);
+Solver randomWalk(Maze maze, const Mouse& mouse, unsigned seed);
+Solver floodFill(Maze maze, const Mouse& mouse);
 
 
 // main function - start
 // --------------------------------------------------------
-int main()
+int main(int argc, char* argv[])
 {
     // setup the maze 
     // ------------------------------------------
@@ -51,10 +71,17 @@ int main()
         return 0;
     }
 
+    // run every strategy headless and report instead of animating
+    if (argc > 1 && std::string(argv[1]) == "--bench") {
+        benchmarkSolvers(maze);
+        return 0;
+    }
+
     // setup the mouse
     // ------------------------------------------
     Mouse mouse = { 0 };
     initializeMouse(mouse);
+    Solver solver = startSolver(SOLVER, maze, mouse);
 
     // setup the window
     // ------------------------------------------
@@ -96,7 +123,7 @@ int main()
         // --------------------------------------------------------
         while (!completed && delta >= FRAME_RATE) {
 
-            completed = update(maze, mouse, delta);
+            completed = update(maze, mouse, solver, delta);
 
             delta -= FRAME_RATE;
         }
@@ -130,7 +157,16 @@ void processInput(sf::RenderWindow& window) {
 } // processInput
 
 
-bool update(Maze maze, Mouse& mouse, float lag) {
+/**
+ * advance the mouse one frame, asking the solver for a new direction
+ * whenever the mouse comes to a stop
+ * @param maze - the maze structure
+ * @param mouse - the mouse structure
+ * @param solver - strategy deciding where the mouse goes next
+ * @param lag - amount of frame time
+ * @return bool - true if the mouse exited the maze or the solver gave up
+ */
+bool update(Maze maze, Mouse& mouse, Solver& solver, float lag) {
     bool done = false;
 
     // check current mouse mode
@@ -142,9 +178,13 @@ bool update(Maze maze, Mouse& mouse, float lag) {
         if (mouse.xPosition >= maze.cells[maze.rows - 1][maze.columns - 1].xCoordinate + CELL_SIZE / 2.f) {
             done = true;
         }
-        else { // see what direction the mouse should check next
-            lookNext(mouse);
+        else if (nextMove(solver, mouse.heading)) { // see what direction the mouse should try next
             mouse.mode = MOUSE_TURNING;
+            if (mouse.facing != mouse.heading)
+                turnToward(mouse);
+        } 
+        else { // strategy ran out of moves
+            done = true;
         } // next direction
 
         break;
@@ -165,8 +205,12 @@ bool update(Maze maze, Mouse& mouse, float lag) {
 
         if (isFinishedTurning(mouse)) { 
 
+            // keep turning one quarter at a time until facing the heading
+            if (mouse.facing != mouse.heading) {
+                turnToward(mouse);
+            }
             // see if mouse can move forward
-            if (!isWallOn(maze, mouse.row, mouse.column, mouse.facing)) {
+            else if (!isWallOn(maze, mouse.row, mouse.column, mouse.facing)) {
                 mouse.mode = MOUSE_MOVING;
                 startMoving(mouse);
             }
@@ -390,41 +434,27 @@ void initializeMouse(Mouse &mouse) {
     mouse.facing = EAST;
     mouse.pointing = 90.f;
     mouse.speedTurning = 0.f;
-    mouse.look = LOOK_LEFT;
+    mouse.heading = EAST;
 
 } // initializeMouse
 
 
-void lookNext(Mouse &mouse) {
-
-    switch (mouse.look) {
-    case LOOK_LEFT:
+/**
+ * start a quarter turn toward the heading, turning around goes right
+ * @param mouse - the mouse structure
+ */
+void turnToward(Mouse &mouse) {
+    if (mouse.heading == leftOf(mouse.facing)) {
         turnLeft(mouse);
-        mouse.look = LOOK_FORWARD;
-        break;
-    case LOOK_FORWARD:
-        turnRight(mouse);
-        mouse.look = LOOK_RIGHT;
-        break;
-    case LOOK_RIGHT:
-        turnRight(mouse);
-        mouse.look = GO_BACK;
-        break;
-    default:    // go back
+    }
+    else {
         turnRight(mouse);
-        mouse.look = LOOK_LEFT;
-    } // search mode
-
-} //doSearch
+    }
+} // turnToward
 
 
 void turnLeft(Mouse &mouse) {
-    if (mouse.facing & NORTH) {
-        mouse.facing = WEST;  // can't shift north to west
-    }
-    else {
-        mouse.facing >>= 1;  // shift downwards (div by 2) to turn left
-    }
+    mouse.facing = leftOf(mouse.facing);
 
     mouse.mode = MOUSE_TURNING;
     mouse.speedTurning = -VELOCITY_TURNING; // turn left
@@ -432,12 +462,7 @@ void turnLeft(Mouse &mouse) {
 
 
 void turnRight(Mouse &mouse) {
-    if (mouse.facing & WEST) {
-        mouse.facing = NORTH;  // can't shift west to north
-    }
-    else {
-        mouse.facing <<= 1;  // shift upwards (mul by 2) to turn right
-    }
+    mouse.facing = rightOf(mouse.facing);
 
     mouse.mode = MOUSE_TURNING;
     mouse.speedTurning = VELOCITY_TURNING; // turn left
@@ -454,9 +479,12 @@ bool isFinishedTurning(Mouse &mouse) {
     if (mouse.speedTurning < 0) { // turning left
         finishedTurning = (mouse.pointing < finishDirection);
     }
-    else {  // turning right
+    else if (mouse.speedTurning > 0) {  // turning right
         finishedTurning = (mouse.pointing > finishDirection);
     }
+    else {  // already facing the heading
+        finishedTurning = true;
+    }
 
     if (finishedTurning) {
         mouse.pointing = finishDirection;   // fix the drawing degrees to new direction
@@ -482,9 +510,6 @@ void startMoving(Mouse& mouse) {
         mouse.speedX = -VELOCITY_MOVING;
     }
 
-    // reset search pattern
-    mouse.look = LOOK_LEFT;
-
 } // startMoving
 
 
@@ -496,9 +521,11 @@ bool isFinishedMoving(Mouse& mouse, Maze maze) {
 
         // moving right - see if done moving to next cell position
         if (mouse.speedX > 0) {
-            if (mouse.xPosition >= maze.cells[mouse.row][mouse.column + 1].xCoordinate) {
+            // the exit has no cell past it, stop one virtual cell over
+            float nextX = maze.cells[mouse.row][mouse.column].xCoordinate + CELL_SIZE;
+            if (mouse.xPosition >= nextX) {
                 finishedMoving = true;
-                mouse.xPosition = maze.cells[mouse.row][mouse.column + 1].xCoordinate;
+                mouse.xPosition = nextX;
                 mouse.column++;
             }
         }
@@ -566,3 +593,468 @@ float cardinalToRotational(BYTE cardinal) {
 } // cardinalToRotational;
 
 
+/**
+ * get the cardinal direction a quarter turn to the left
+ * @param cardinal - the cardinal direction
+ * @return BYTE - the direction to the left
+ */
+BYTE leftOf(BYTE cardinal) {
+    if (cardinal & NORTH)
+        return WEST;        // can't shift north to west
+
+    return cardinal >> 1;   // shift downwards (div by 2) to turn left
+} // leftOf
+
+
+/**
+ * get the cardinal direction a quarter turn to the right
+ * @param cardinal - the cardinal direction
+ * @return BYTE - the direction to the right
+ */
+BYTE rightOf(BYTE cardinal) {
+    if (cardinal & WEST)
+        return NORTH;       // can't shift west to north
+
+    return cardinal << 1;   // shift upwards (mul by 2) to turn right
+} // rightOf
+
+
+/**
+ * get the opposite cardinal direction
+ * @param cardinal - the cardinal direction
+ * @return BYTE - the direction behind
+ */
+BYTE behind(BYTE cardinal) {
+    return rightOf(rightOf(cardinal));
+} // behind
+
+
+
+// --------------------------------------------------------
+// Solver Methods
+// --------------------------------------------------------
+
+
+/**
+ * create a suspended solver coroutine for a strategy
+ * @param strategy - which solver to run (SOLVER_*)
+ * @param maze - the maze structure
+ * @param mouse - the mouse the solver steers, must outlive the solver
+ * @param seed - random seed for strategies that use one
+ * @return Solver - the suspended strategy
+ */
+Solver startSolver(int strategy, Maze maze, const Mouse& mouse, unsigned seed) {
+    switch (strategy) {
+    case SOLVER_TREMAUX:
+        return tremaux(maze, mouse);
+    case SOLVER_PLEDGE:
+        return pledge(maze, mouse);
+    case SOLVER_RANDOM_WALK:
+        return randomWalk(maze, mouse, seed);
+    case SOLVER_FLOOD_FILL:
+        return floodFill(maze, mouse);
+    default: // SOLVER_WALL_FOLLOWER
+        return wallFollower(maze, mouse);
+    }
+} // startSolver
+
+
+/**
+ * resume a solver until it yields its next direction
+ * @param solver - the strategy coroutine
+ * @param move - set to the direction the mouse should try next
+ * @return bool - false if the strategy has finished
+ */
+bool nextMove(Solver& solver, BYTE& move) {
+    if (!solver.handle || solver.handle.done())
+        return false;
+
+    solver.handle.resume();
+    if (solver.handle.done())
+        return false;
+
+    move = solver.handle.promise().move;
+    return true;
+} // nextMove
+
+
+/**
+ * run BENCH_INSTANCES mice per strategy side by side without a window
+ * and print how long each strategy takes to reach the exit
+ * @param maze - the maze structure
+ */
+void benchmarkSolvers(Maze maze) {
+
+    for (int strategy = 0; strategy < SOLVER_COUNT; strategy++) {
+        sf::Clock clock;
+
+        // mice must not move in memory once their solvers hold them
+        std::vector<Mouse> mice(BENCH_INSTANCES, Mouse{ 0 });
+        std::vector<Solver> solvers(BENCH_INSTANCES);
+        std::vector<int> frames(BENCH_INSTANCES, BENCH_MAX_FRAMES);
+
+        for (int i = 0; i < BENCH_INSTANCES; i++) {
+            initializeMouse(mice[i]);
+            solvers[i] = startSolver(strategy, maze, mice[i], i);
+        }
+
+        // step every unfinished mouse one frame at a time
+        int running = BENCH_INSTANCES;
+        for (int frame = 0; frame < BENCH_MAX_FRAMES && running > 0; frame++) {
+            for (int i = 0; i < BENCH_INSTANCES; i++) {
+                if (frames[i] == BENCH_MAX_FRAMES && update(maze, mice[i], solvers[i], FRAME_RATE)) {
+                    frames[i] = frame;
+                    running--;
+                }
+            }
+        }
+
+        // only count mice that actually got out of the maze
+        int escaped = 0;
+        long long totalFrames = 0;
+        for (int i = 0; i < BENCH_INSTANCES; i++) {
+            if (mice[i].column >= maze.columns) {
+                escaped++;
+                totalFrames += frames[i];
+            }
+        }
+
+        std::cout << SOLVER_NAMES[strategy] << ": " << escaped << "/" << BENCH_INSTANCES << " escaped";
+        if (escaped)
+            std::cout << ", avg " << totalFrames * FRAME_RATE / escaped << "s simulated";
+        std::cout << ", " << clock.getElapsedTime().asMilliseconds() << "ms real\n";
+
+    } // strategies
+
+} // benchmarkSolvers
+
+
+/**
+ * check if the mouse can leave a cell in a direction without
+ * leaving the maze anywhere but the exit
+ * @param maze - the maze structure
+ * @param row - cell row to check
+ * @param column - cell column to check
+ * @param direction - which way to go
+ * @return bool - true if the way is open
+ */
+bool isOpen(Maze maze, int row, int column, BYTE direction) {
+    if (isWallOn(maze, row, column, direction))
+        return false;
+
+    if (isGoal(maze, row, column) && direction == EAST)
+        return true;
+
+    stepToward(direction, row, column);
+    return row >= 0 && row < maze.rows && column >= 0 && column < maze.columns;
+} // isOpen
+
+
+/**
+ * check if a cell is the bottom right cell next to the exit
+ * @param maze - the maze structure
+ * @param row - cell row to check
+ * @param column - cell column to check
+ * @return bool - true if the cell leads out of the maze
+ */
+bool isGoal(Maze maze, int row, int column) {
+    return row == maze.rows - 1 && column == maze.columns - 1;
+} // isGoal
+
+
+/**
+ * move cell coordinates one cell in a direction
+ * @param direction - which way to go
+ * @param row - modify the row coordinate
+ * @param column - modify the column coordinate
+ */
+void stepToward(BYTE direction, int& row, int& column) {
+    switch (direction) {
+    case NORTH:
+        row--;
+        break;
+    case EAST:
+        column++;
+        break;
+    case SOUTH:
+        row++;
+        break;
+    default: // WEST
+        column--;
+    }
+} // stepToward
+
+
+/**
+ * convert a cardinal direction to an index 0 - 3 (North -> West)
+ * @param direction - the cardinal direction
+ * @return int - the index
+ */
+int directionIndex(BYTE direction) {
+    switch (direction) {
+    case NORTH:
+        return 0;
+    case EAST:
+        return 1;
+    case SOUTH:
+        return 2;
+    default: // WEST
+        return 3;
+    }
+} // directionIndex
+
+
+/**
+ * left hand wall follower - look left, forward, right then back,
+ * starting over from the left after every cell the mouse moves
+ * @param maze - unused, walls are found by bumping into them
+ * @param mouse - the mouse being steered
+ * @return Solver - the suspended strategy
+ */
+Solver wallFollower(Maze, const Mouse& mouse) {
+    for (;;) {
+        int row = mouse.row;
+        int column = mouse.column;
+        BYTE forward = mouse.facing;
+        BYTE pattern[] = { leftOf(forward), forward, rightOf(forward), behind(forward) };
+
+        for (BYTE look : pattern) {
+            co_yield look;
+
+            // stop looking once the mouse made it to another cell
+            if (mouse.row != row || mouse.column != column)
+                break;
+        }
+    }
+} // wallFollower
+
+
+/**
+ * tremaux - mark each passage as it is walked, never take a passage
+ * marked twice, and turn back when arriving somewhere already visited
+ * @param maze - the maze structure
+ * @param mouse - the mouse being steered
+ * @return Solver - the suspended strategy
+ */
+Solver tremaux(Maze maze, const Mouse& mouse) {
+    std::vector<BYTE> marks(maze.rows * maze.columns * 4, 0);   // walks per passage end
+    std::vector<bool> visited(maze.rows * maze.columns, false);
+    BYTE entry = 0;     // direction back down the passage we came in on (0 at start)
+
+    for (;;) {
+        int row = mouse.row;
+        int column = mouse.column;
+        int cell = row * maze.columns + column;
+
+        if (isGoal(maze, row, column)) {
+            co_yield EAST;
+            continue;
+        }
+
+        BYTE next = 0;
+
+        // came into a cell we've seen before down a new passage, go back
+        if (entry && visited[cell] && marks[cell * 4 + directionIndex(entry)] == 1) {
+            next = entry;
+        }
+        else { // take the least walked open passage, preferring not to go back
+            int fewest = 2;
+            BYTE direction = mouse.facing;
+            for (int turn = 0; turn < 4; turn++) {
+                if (isOpen(maze, row, column, direction)) {
+                    int walked = marks[cell * 4 + directionIndex(direction)];
+                    if (walked < fewest || (walked == fewest && next == entry)) {
+                        fewest = walked;
+                        next = direction;
+                    }
+                }
+                direction = rightOf(direction);
+            }
+        }
+
+        // boxed in with every passage walked twice
+        if (!next)
+            co_return;
+
+        visited[cell] = true;
+
+        // mark both ends of the passage
+        int nextRow = row;
+        int nextColumn = column;
+        stepToward(next, nextRow, nextColumn);
+        marks[cell * 4 + directionIndex(next)]++;
+        marks[(nextRow * maze.columns + nextColumn) * 4 + directionIndex(behind(next))]++;
+
+        entry = behind(next);
+        co_yield next;
+    }
+} // tremaux
+
+
+/**
+ * pledge - head east until blocked, then follow the wall on the left
+ * until the turns taken add back up to zero facing east again
+ * @param maze - the maze structure
+ * @param mouse - the mouse being steered
+ * @return Solver - the suspended strategy
+ */
+Solver pledge(Maze maze, const Mouse& mouse) {
+    const BYTE mainDirection = EAST;
+    BYTE heading = mainDirection;
+    int turns = 0;      // net quarter turns, right positive
+
+    for (;;) {
+        int row = mouse.row;
+        int column = mouse.column;
+
+        if (turns == 0) {
+            if (isOpen(maze, row, column, mainDirection)) {
+                co_yield mainDirection;
+                continue;
+            }
+
+            // blocked, turn right until open to put the wall on the left
+            heading = rightOf(heading);
+            turns++;
+        }
+        else { // follow the wall: left, forward, right then back
+            heading = leftOf(heading);
+            turns--;
+        }
+
+        // keep turning right, at most all the way around
+        for (int turn = 1; turn < 4 && !isOpen(maze, row, column, heading); turn++) {
+            heading = rightOf(heading);
+            turns++;
+        }
+
+        // walled in on all sides
+        if (!isOpen(maze, row, column, heading))
+            co_return;
+
+        co_yield heading;
+    }
+} // pledge
+
+
+/**
+ * random walk - wander to any open neighbouring cell
+ * @param maze - the maze structure
+ * @param mouse - the mouse being steered
+ * @param seed - random seed so each instance wanders differently
+ * @return Solver - the suspended strategy
+ */
+Solver randomWalk(Maze maze, const Mouse& mouse, unsigned seed) {
+    std::minstd_rand random(seed + 1);      // minstd rejects a zero seed
+
+    for (;;) {
+        BYTE choices[4];
+        int count = 0;
+
+        BYTE direction = NORTH;
+        for (int turn = 0; turn < 4; turn++) {
+            if (isOpen(maze, mouse.row, mouse.column, direction))
+                choices[count++] = direction;
+            direction = rightOf(direction);
+        }
+
+        // walled in on all sides
+        if (!count)
+            co_return;
+
+        co_yield choices[random() % count];
+    }
+} // randomWalk
+
+
+/**
+ * flood fill - micromouse style, sense the walls of each cell entered
+ * and always move toward the neighbour closest to the exit assuming
+ * any wall not seen yet is not there
+ * @param maze - the maze structure
+ * @param mouse - the mouse being steered
+ * @return Solver - the suspended strategy
+ */
+Solver floodFill(Maze maze, const Mouse& mouse) {
+    int cells = maze.rows * maze.columns;
+    std::vector<BYTE> knownWalls(cells, 0);
+    std::vector<int> distance(cells);
+    std::vector<int> queue(cells);
+
+    for (;;) {
+        int row = mouse.row;
+        int column = mouse.column;
+
+        if (isGoal(maze, row, column)) {
+            co_yield EAST;
+            continue;
+        }
+
+        // sense the walls around this cell, and the neighbours' matching sides
+        BYTE direction = NORTH;
+        for (int turn = 0; turn < 4; turn++) {
+            if (!isOpen(maze, row, column, direction)) {
+                knownWalls[row * maze.columns + column] |= direction;
+
+                int nextRow = row;
+                int nextColumn = column;
+                stepToward(direction, nextRow, nextColumn);
+                if (nextRow >= 0 && nextRow < maze.rows && nextColumn >= 0 && nextColumn < maze.columns)
+                    knownWalls[nextRow * maze.columns + nextColumn] |= behind(direction);
+            }
+            direction = rightOf(direction);
+        }
+
+        // flood distances out from the goal through known walls
+        std::fill(distance.begin(), distance.end(), cells);
+        int head = 0;
+        int tail = 0;
+        int goal = cells - 1;
+        distance[goal] = 0;
+        queue[tail++] = goal;
+
+        while (head < tail) {
+            int cell = queue[head++];
+
+            direction = NORTH;
+            for (int turn = 0; turn < 4; turn++) {
+                int nextRow = cell / maze.columns;
+                int nextColumn = cell % maze.columns;
+                stepToward(direction, nextRow, nextColumn);
+
+                if (!(knownWalls[cell] & direction) &&
+                    nextRow >= 0 && nextRow < maze.rows && nextColumn >= 0 && nextColumn < maze.columns) {
+                    int next = nextRow * maze.columns + nextColumn;
+                    if (distance[next] > distance[cell] + 1) {
+                        distance[next] = distance[cell] + 1;
+                        queue[tail++] = next;
+                    }
+                }
+                direction = rightOf(direction);
+            }
+        }
+
+        // head downhill, keep going straight on a tie
+        BYTE next = 0;
+        int closest = cells;
+        direction = mouse.facing;
+        for (int turn = 0; turn < 4; turn++) {
+            if (isOpen(maze, row, column, direction)) {
+                int nextRow = row;
+                int nextColumn = column;
+                stepToward(direction, nextRow, nextColumn);
+                if (distance[nextRow * maze.columns + nextColumn] < closest) {
+                    closest = distance[nextRow * maze.columns + nextColumn];
+                    next = direction;
+                }
+            }
+            direction = rightOf(direction);
+        }
+
+        // no way to the exit
+        if (!next)
+            co_return;
+
+        co_yield next;
+    }
+} // floodFill